@@ -50,6 +50,8 @@
 
 - (instancetype)initWithDictionary:(NSDictionary *)dict;
 
++ (NSSet *)generatedKeys;
+
 - (void)loadDefaultValues;
 - (void)upgradeValues;
 - (void)upgradeValuesWithDictionary:(NSDictionary *)dict;
@@ -62,5 +64,136 @@
 
 - (void)setValueForKey:(NSString *)key fromOldKey:(NSString *)oldKey inDictionary:(NSDictionary *)dict;
 
+- (id)processValue:(id)value;
+- (id)dictionaryValueForValue:(id)value;
+
+- (void)addGeneratedValuesToDictionary:(NSMutableDictionary *)dict;
+- (void)setGeneratedValuesFromDictionary:(NSDictionary *)dict;
+
 @end
 
+
+/*
+ Generated saved properties.
+ 
+ Instead of hand-writing -savedKeys, -initWithCoder: and -encodeWithCoder: with separate key constants, a subclass can describe its saved properties once as a list macro, then expand DEJAL_OBJECT_SAVED_PROPERTIES() inside its @implementation.  The property name is used as the key.  The generated methods access each property directly via its accessor, rather than via Key-Value Coding; subclasses that don't use this continue to use KVC.  For example:
+ 
+    #define DemoSavedProperties(OBJECT, ARRAY, INTEGER, DOUBLE, BOOLEAN) \
+        OBJECT(text, NSString) \
+        INTEGER(number) \
+        OBJECT(label, DejalColor) \
+        OBJECT(when, DejalDate) \
+        ARRAY(history, DejalDate)
+    
+    @implementation Demo
+    
+    DEJAL_OBJECT_SAVED_PROPERTIES(DemoSavedProperties)
+    
+    ...
+    
+    @end
+ 
+ The generated -savedKeys caches its result, including the superclass's saved keys, the first time it is called, and the keys that still need Key-Value Coding are likewise cached per class.  So the saved keys of a class using this macro, and of its superclasses and subclasses, must depend only on the class, not on the instance.
+ 
+ OBJECT is for non-array object properties, with the class to decode; DejalObject values are converted to and from dictionary representations, other objects are saved as-is, and a loaded value that isn't of that class is ignored.  ARRAY is for NSArray properties, with the class of the elements to decode; DejalObject elements are converted to and from dictionary representations, and a loaded value that isn't an array is ignored.  INTEGER for NSInteger (or smaller integer) properties, DOUBLE for double or CGFloat properties, and BOOLEAN for BOOL properties; these are loaded from a number or string, and any other loaded value is ignored.
+ */
+
+#define DEJAL_OBJECT_SAVED_PROPERTIES(PROPERTIES) \
+\
++ (NSSet *)generatedKeys; \
+{ \
+    static NSSet *keys = nil; \
+    static dispatch_once_t onceToken; \
+    dispatch_once(&onceToken, ^{ \
+        NSMutableSet *mutableKeys = [[super generatedKeys] mutableCopy]; \
+        PROPERTIES(DEJAL_OBJECT_PRIVATE_KEY_OBJECT, DEJAL_OBJECT_PRIVATE_KEY_OBJECT, DEJAL_OBJECT_PRIVATE_KEY_SCALAR, DEJAL_OBJECT_PRIVATE_KEY_SCALAR, DEJAL_OBJECT_PRIVATE_KEY_SCALAR) \
+        keys = [mutableKeys copy]; \
+    }); \
+    return keys; \
+} \
+\
+- (NSArray *)savedKeys; \
+{ \
+    static NSArray *keys = nil; \
+    static dispatch_once_t onceToken; \
+    dispatch_once(&onceToken, ^{ \
+        NSMutableArray *mutableKeys = [[super savedKeys] mutableCopy]; \
+        PROPERTIES(DEJAL_OBJECT_PRIVATE_KEY_OBJECT, DEJAL_OBJECT_PRIVATE_KEY_OBJECT, DEJAL_OBJECT_PRIVATE_KEY_SCALAR, DEJAL_OBJECT_PRIVATE_KEY_SCALAR, DEJAL_OBJECT_PRIVATE_KEY_SCALAR) \
+        keys = [mutableKeys copy]; \
+    }); \
+    return keys; \
+} \
+\
+- (instancetype)initWithCoder:(NSCoder *)decoder; \
+{ \
+    if ((self = [super initWithCoder:decoder])) \
+    { \
+        PROPERTIES(DEJAL_OBJECT_PRIVATE_DECODE_OBJECT, DEJAL_OBJECT_PRIVATE_DECODE_ARRAY, DEJAL_OBJECT_PRIVATE_DECODE_INTEGER, DEJAL_OBJECT_PRIVATE_DECODE_DOUBLE, DEJAL_OBJECT_PRIVATE_DECODE_BOOLEAN) \
+    } \
+    return self; \
+} \
+\
+- (void)encodeWithCoder:(NSCoder *)encoder; \
+{ \
+    [super encodeWithCoder:encoder]; \
+    PROPERTIES(DEJAL_OBJECT_PRIVATE_ENCODE_OBJECT, DEJAL_OBJECT_PRIVATE_ENCODE_OBJECT, DEJAL_OBJECT_PRIVATE_ENCODE_INTEGER, DEJAL_OBJECT_PRIVATE_ENCODE_DOUBLE, DEJAL_OBJECT_PRIVATE_ENCODE_BOOLEAN) \
+} \
+\
++ (BOOL)supportsSecureCoding; \
+{ \
+    return YES; \
+} \
+\
+- (void)addGeneratedValuesToDictionary:(NSMutableDictionary *)dict; \
+{ \
+    [super addGeneratedValuesToDictionary:dict]; \
+    PROPERTIES(DEJAL_OBJECT_PRIVATE_GET_OBJECT, DEJAL_OBJECT_PRIVATE_GET_ARRAY, DEJAL_OBJECT_PRIVATE_GET_SCALAR, DEJAL_OBJECT_PRIVATE_GET_SCALAR, DEJAL_OBJECT_PRIVATE_GET_SCALAR) \
+} \
+\
+- (void)setGeneratedValuesFromDictionary:(NSDictionary *)dict; \
+{ \
+    [super setGeneratedValuesFromDictionary:dict]; \
+    PROPERTIES(DEJAL_OBJECT_PRIVATE_SET_OBJECT, DEJAL_OBJECT_PRIVATE_SET_ARRAY, DEJAL_OBJECT_PRIVATE_SET_INTEGER, DEJAL_OBJECT_PRIVATE_SET_DOUBLE, DEJAL_OBJECT_PRIVATE_SET_BOOLEAN) \
+}
+
+// Helpers for DEJAL_OBJECT_SAVED_PROPERTIES(); not intended to be used directly:
+
+#define DEJAL_OBJECT_PRIVATE_KEY_OBJECT(name, cls) [mutableKeys addObject:@#name];
+#define DEJAL_OBJECT_PRIVATE_KEY_SCALAR(name) [mutableKeys addObject:@#name];
+
+#define DEJAL_OBJECT_PRIVATE_DECODE_OBJECT(name, cls) self.name = [decoder decodeObjectOfClass:[cls class] forKey:@#name];
+#define DEJAL_OBJECT_PRIVATE_DECODE_ARRAY(name, elementCls) self.name = [decoder decodeObjectOfClasses:[NSSet setWithObjects:[NSArray class], [elementCls class], nil] forKey:@#name];
+#define DEJAL_OBJECT_PRIVATE_DECODE_INTEGER(name) self.name = [decoder decodeIntegerForKey:@#name];
+#define DEJAL_OBJECT_PRIVATE_DECODE_DOUBLE(name) self.name = [decoder decodeDoubleForKey:@#name];
+#define DEJAL_OBJECT_PRIVATE_DECODE_BOOLEAN(name) self.name = [decoder decodeBoolForKey:@#name];
+
+#define DEJAL_OBJECT_PRIVATE_ENCODE_OBJECT(name, cls) [encoder encodeObject:self.name forKey:@#name];
+#define DEJAL_OBJECT_PRIVATE_ENCODE_INTEGER(name) [encoder encodeInteger:self.name forKey:@#name];
+#define DEJAL_OBJECT_PRIVATE_ENCODE_DOUBLE(name) [encoder encodeDouble:self.name forKey:@#name];
+#define DEJAL_OBJECT_PRIVATE_ENCODE_BOOLEAN(name) [encoder encodeBool:self.name forKey:@#name];
+
+#define DEJAL_OBJECT_PRIVATE_CONVERTS(cls) \
+    static BOOL converts = NO; \
+    static dispatch_once_t convertsOnceToken; \
+    dispatch_once(&convertsOnceToken, ^{ converts = [cls isSubclassOfClass:[DejalObject class]]; });
+
+#define DEJAL_OBJECT_PRIVATE_GET_OBJECT(name, cls) \
+{ \
+    DEJAL_OBJECT_PRIVATE_CONVERTS(cls) \
+    id value = converts ? [self dictionaryValueForValue:self.name] : self.name; \
+    if (value) { dict[@#name] = value; } \
+}
+#define DEJAL_OBJECT_PRIVATE_GET_ARRAY(name, elementCls) { id value = [self dictionaryValueForValue:self.name]; if (value) { dict[@#name] = value; } }
+#define DEJAL_OBJECT_PRIVATE_GET_SCALAR(name) dict[@#name] = @(self.name);
+
+#define DEJAL_OBJECT_PRIVATE_SET_OBJECT(name, cls) \
+{ \
+    DEJAL_OBJECT_PRIVATE_CONVERTS(cls) \
+    id value = converts ? [self processValue:dict[@#name]] : dict[@#name]; \
+    if ([value isKindOfClass:[cls class]]) { self.name = value; } \
+}
+#define DEJAL_OBJECT_PRIVATE_SET_ARRAY(name, elementCls) { id value = dict[@#name]; if ([value isKindOfClass:[NSArray class]]) { self.name = [self processValue:value]; } }
+#define DEJAL_OBJECT_PRIVATE_IS_SCALAR(value) ([value isKindOfClass:[NSNumber class]] || [value isKindOfClass:[NSString class]])
+#define DEJAL_OBJECT_PRIVATE_SET_INTEGER(name) { id value = dict[@#name]; if (DEJAL_OBJECT_PRIVATE_IS_SCALAR(value)) { self.name = [value integerValue]; } }
+#define DEJAL_OBJECT_PRIVATE_SET_DOUBLE(name) { id value = dict[@#name]; if (DEJAL_OBJECT_PRIVATE_IS_SCALAR(value)) { self.name = [value doubleValue]; } }
+#define DEJAL_OBJECT_PRIVATE_SET_BOOLEAN(name) { id value = dict[@#name]; if (DEJAL_OBJECT_PRIVATE_IS_SCALAR(value)) { self.name = [value boolValue]; } }
@@ -28,6 +28,7 @@
 //
 
 #import "DejalObject.h"
+#import <objc/runtime.h>
 
 
 NSUInteger const DejalObjectVersion = 1;
@@ -35,9 +36,13 @@ NSUInteger const DejalObjectVersion = 1;
 NSString * const DejalObjectKeyClassName = @"representedClassName";
 NSString * const DejalObjectKeyVersion = @"version";
 
+static char DejalObjectDynamicSavedKeysKey;
+
 
 @interface DejalObject ()
 
+@property (nonatomic, strong, readonly) NSArray *dynamicSavedKeys;
+
 @end
 
 
@@ -228,37 +233,16 @@ NSString * const DejalObjectKeyVersion = @"version";
  @version DJS 2014-01: Changed to recursively get the dictionary representation of objects in the receiver's properties.
  @version DJS 2014-05: Changed to avoid an exception if a value is nil, and recursively get dictionary representations of objects in an array property.
  @version DJS 2014-02: Changed to no longer set hasChanges to NO; it should be done explicitly.
+ @version DJS 2026-10: Changed to only use KVC for keys that aren't generated via DEJAL_OBJECT_SAVED_PROPERTIES().
 */
 
 - (NSDictionary *)dictionary;
 {
     NSMutableDictionary *dict = [NSMutableDictionary dictionary];
     
-    for (NSString *key in self.savedKeys)
+    for (NSString *key in self.dynamicSavedKeys)
     {
-        id value = [self valueForKey:key];
-        
-        if ([value isKindOfClass:[NSArray class]] && [[value firstObject] isKindOfClass:[DejalObject class]])
-        {
-            // The value is an array of represented objects, so make an array of dictionary representations of them:
-            NSMutableArray *array = [NSMutableArray arrayWithCapacity:[value count]];
-            
-            for (DejalObject *object in value)
-            {
-                NSDictionary *subDict = [object dictionary];
-                
-                if (subDict)
-                {
-                    [array addObject:subDict];
-                }
-            }
-            
-            value = array;
-        }
-        else if ([value isKindOfClass:[DejalObject class]])
-        {
-            value = [value dictionary];
-        }
+        id value = [self dictionaryValueForValue:[self valueForKey:key]];
         
         if (value)
         {
@@ -266,6 +250,8 @@ NSString * const DejalObjectKeyVersion = @"version";
         }
     }
     
+    [self addGeneratedValuesToDictionary:dict];
+    
     return dict;
 }
 
@@ -275,13 +261,19 @@ NSString * const DejalObjectKeyVersion = @"version";
  @author DJS 2011-12.
  @version DJS 2015-02: Renamed from -loadFromDictionary: to setDictionary:, so it works as a property.
  @version DJS 2015-09: Now upgrades the values and updates the version after loading.
+ @version DJS 2026-10: Changed to only use KVC for keys that aren't generated via DEJAL_OBJECT_SAVED_PROPERTIES().
  */
 
 - (void)setDictionary:(NSDictionary *)dict;
 {
     NSInteger vers = self.version;
     
-    [self setValuesForKeys:self.savedKeys withDictionary:dict];
+    [self setValuesForKeys:self.dynamicSavedKeys withDictionary:dict];
+    
+    if (dict)
+    {
+        [self setGeneratedValuesFromDictionary:dict];
+    }
     
     [self upgradeValuesWithDictionary:dict];
     
@@ -454,6 +446,7 @@ NSString * const DejalObjectKeyVersion = @"version";
  @returns The processed value.
  
  @author DJS 2014-05.
+ @version DJS 2026-10: Fixed adding the unprocessed objects to the array, instead of the processed ones.
  */
 
 - (id)processValue:(id)value;
@@ -484,16 +477,136 @@ NSString * const DejalObjectKeyVersion = @"version";
             
             if (processed)
             {
-                [array addObject:object];
+                [array addObject:processed];
+            }
+        }
+        
+        return array;
+    }
+    
+    return value;
+}
+
+/**
+ Converts a property value to its dictionary representation: a represented object becomes its dictionary, and an array of represented objects becomes an array of their dictionaries.  Other values are returned as-is.
+ 
+ @param value The value to convert.
+ @returns The converted value.
+ 
+ @author DJS 2014-05.
+ @version DJS 2026-10: Extracted from -dictionary so generated subclasses can use it too.
+ */
+
+- (id)dictionaryValueForValue:(id)value;
+{
+    if ([value isKindOfClass:[NSArray class]] && [[value firstObject] isKindOfClass:[DejalObject class]])
+    {
+        // The value is an array of represented objects, so make an array of dictionary representations of them:
+        NSMutableArray *array = [NSMutableArray arrayWithCapacity:[value count]];
+        
+        for (DejalObject *object in value)
+        {
+            NSDictionary *subDict = [object dictionary];
+            
+            if (subDict)
+            {
+                [array addObject:subDict];
             }
         }
         
         return array;
     }
+    else if ([value isKindOfClass:[DejalObject class]])
+    {
+        return [value dictionary];
+    }
     
     return value;
 }
 
+/**
+ Returns the keys of the properties that are loaded and saved via generated accessor code, from DEJAL_OBJECT_SAVED_PROPERTIES(), instead of Key-Value Coding.  Subclasses shouldn't override this directly; the macro does so.
+ 
+ @returns A set of keys; empty by default.
+ 
+ @author DJS 2026-10.
+ */
+
++ (NSSet *)generatedKeys;
+{
+    return [NSSet set];
+}
+
+/**
+ Returns the saved keys that aren't generated, i.e. that need to be loaded and saved via Key-Value Coding.  For classes that use DEJAL_OBJECT_SAVED_PROPERTIES(), this is worked out once per class and stored on the class, so the saved keys are assumed not to vary between instances of the same class.
+ 
+ @returns An array of keys.
+ 
+ @author DJS 2026-10.
+ @version DJS 2026-10: Changed to store the keys as an associated object of the class, instead of in a shared, locked map table.
+ */
+
+- (NSArray *)dynamicSavedKeys;
+{
+    Class class = [self class];
+    NSArray *dynamicKeys = objc_getAssociatedObject(class, &DejalObjectDynamicSavedKeysKey);
+    
+    if (dynamicKeys)
+    {
+        return dynamicKeys;
+    }
+    
+    NSSet *generatedKeys = [class generatedKeys];
+    
+    if (!generatedKeys.count)
+    {
+        return self.savedKeys;
+    }
+    
+    NSMutableArray *keys = [NSMutableArray array];
+    
+    for (NSString *key in self.savedKeys)
+    {
+        if (![generatedKeys containsObject:key])
+        {
+            [keys addObject:key];
+        }
+    }
+    
+    dynamicKeys = [keys copy];
+    
+    // If another thread gets here too, it stores an identical array, so the race is harmless:
+    objc_setAssociatedObject(class, &DejalObjectDynamicSavedKeysKey, dynamicKeys, OBJC_ASSOCIATION_RETAIN);
+    
+    return dynamicKeys;
+}
+
+/**
+ Adds the generated properties of the receiver to the dictionary representation.  Does nothing by default; DEJAL_OBJECT_SAVED_PROPERTIES() overrides this, calling super.
+ 
+ @param dict The dictionary representation being built.
+ 
+ @author DJS 2026-10.
+ */
+
+- (void)addGeneratedValuesToDictionary:(NSMutableDictionary *)dict;
+{
+    // Does nothing by default
+}
+
+/**
+ Sets the generated properties of the receiver from the dictionary representation.  Does nothing by default; DEJAL_OBJECT_SAVED_PROPERTIES() overrides this, calling super.
+ 
+ @param dict The dictionary representation to load.
+ 
+ @author DJS 2026-10.
+ */
+
+- (void)setGeneratedValuesFromDictionary:(NSDictionary *)dict;
+{
+    // Does nothing by default
+}
+
 /**
  Sets the properties with the specified keys from the dictionary.  Only sets the properties if there are corresponding values in the dictionary; otherwise the previous values remain (e.g. from the default values).  Subclasses shouldn't need to override this.
  
@@ -25,6 +25,10 @@
     
     self.demo = [Demo objectWithDictionary:dict];
     
+#if DEBUG
+    [self verifyRoundTrips];
+#endif
+    
     self.textField.stringValue = self.demo.text;
     self.numberField.integerValue = self.demo.number;
     self.colorWell.color = self.demo.label.color;
@@ -46,5 +50,57 @@
     }
 }
 
+#if DEBUG
+
+/**
+ Checks that the demo object survives being saved and loaded via its dictionary, JSON, keyed archiving and copying, to exercise the code generated by DEJAL_OBJECT_SAVED_PROPERTIES().  Only included in debug builds, where the assertions are enabled.  DejalColor archives its components as floats, so the archived and copied objects are compared by property, and the color components within a tolerance.
+ 
+ @author DJS 2026-10.
+ */
+
+- (void)verifyRoundTrips;
+{
+    Demo *demo = self.demo;
+    
+    Demo *fromDictionary = [Demo objectWithDictionary:demo.dictionary];
+    NSAssert([fromDictionary isEqualToObject:demo], @"Dictionary round trip failed: %@ vs %@", fromDictionary, demo);
+    
+    Demo *fromJSON = [Demo objectWithJSON:demo.json];
+    NSAssert([fromJSON isEqualToObject:demo], @"JSON round trip failed: %@ vs %@", fromJSON, demo);
+    NSAssert([fromJSON.label isKindOfClass:[DejalColor class]] && [fromJSON.when isKindOfClass:[DejalDate class]] && [fromJSON.history.firstObject isKindOfClass:[DejalDate class]], @"JSON round trip didn't restore the represented objects");
+    
+    NSData *data = [NSKeyedArchiver archivedDataWithRootObject:demo requiringSecureCoding:YES error:nil];
+    Demo *fromArchive = [NSKeyedUnarchiver unarchivedObjectOfClass:[Demo class] fromData:data error:nil];
+    Demo *copy = [demo copy];
+    
+    for (Demo *other in @[fromArchive ?: [NSNull null], copy ?: [NSNull null]])
+    {
+        NSAssert([other isKindOfClass:[Demo class]], @"Archiving or copying failed");
+        NSAssert([other.text isEqualToString:demo.text] && other.number == demo.number, @"Archived or copied values differ: %@ vs %@", other, demo);
+        NSAssert([other.when.string isEqualToString:demo.when.string], @"Archived or copied dates differ: %@ vs %@", other.when, demo.when);
+        
+        DejalColor *label = other.label;
+        CGFloat tolerance = 0.0001;
+        
+        NSAssert([label isKindOfClass:[DejalColor class]] && fabs(label.red - demo.label.red) < tolerance && fabs(label.green - demo.label.green) < tolerance && fabs(label.blue - demo.label.blue) < tolerance && fabs(label.alpha - demo.label.alpha) < tolerance, @"Archived or copied colors differ: %@ vs %@", label, demo.label);
+        
+        NSAssert(other.history.count == demo.history.count && [other.history.firstObject isKindOfClass:[DejalDate class]] && [[other.history.firstObject string] isEqualToString:[demo.history.firstObject string]], @"Archived or copied arrays differ: %@ vs %@", other.history, demo.history);
+    }
+    
+    NSMutableDictionary *malformed = [demo.dictionary mutableCopy];
+    
+    malformed[@"text"] = @42;
+    malformed[@"number"] = [NSNull null];
+    
+    Demo *fromMalformed = [Demo objectWithDictionary:malformed];
+    
+    NSAssert([fromMalformed.text isEqualToString:[Demo object].text], @"A wrongly typed object value was loaded");
+    NSAssert(fromMalformed.number == [Demo object].number, @"A wrongly typed scalar value was loaded");
+    
+    NSLog(@"Demo round trips verified");  // log
+}
+
+#endif
+
 @end
 
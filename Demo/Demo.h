@@ -17,6 +17,7 @@
 @property (nonatomic) NSInteger number;
 @property (nonatomic, strong) DejalColor *label;
 @property (nonatomic, strong) DejalDate *when;
+@property (nonatomic, strong) NSArray<DejalDate *> *history;
 
 @end
 